@@ -10,8 +10,11 @@
 #include <sys/shm.h>
 #include <sys/wait.h>
 #include <sys/types.h>
+#include <dlfcn.h>
+#include <math.h>
+
+#include "admiral-strategy.h"
 
-#define GRID_SIZE 8          // Size of the game grid (8x8)
 #define GAME_CONTINUE 0      // Game is ongoing
 #define GAME_OVER 1          // Game has ended
 #define PARENT_TURN 0        // Parent's turn
@@ -21,6 +24,10 @@
 #define MOVE_INTERVAL 250         // Interval between moves in milliseconds
 #define SHM_KEY 1234                // Shared memory key for IPC
 
+#define DEFAULT_STRATEGY "hunt"     // Strategy used when none is given
+#define DEFAULT_AB_GAMES 1000       // Seeded fleet pairs played by an A/B comparison
+#define CONFIDENCE_Z 1.96           // Normal quantile for 95% confidence intervals
+
 // Structure to define ship types
 typedef struct {
     int length;         // Length of the ship
@@ -47,8 +54,41 @@ typedef struct {
     int gameStatus[2];  // [0]: GAME_CONTINUE or GAME_OVER, [1]: PARENT_TURN or CHILD_TURN
 } GameState;
 
+// A strategy together with its per-instance state
+typedef struct {
+    const Strategy *strategy;  // Function table driving the attacks
+    void *state;               // strategy->stateSize bytes owned by this player
+} Player;
+
+// State of the built-in "hunt" strategy
+typedef struct {
+    unsigned int seed;          // rand_r() state
+    int lastHitX, lastHitY;     // Coordinates of the last hit
+} HuntState;
+
+// State of the built-in "random" strategy
+typedef struct {
+    unsigned int seed;          // rand_r() state
+} RandomState;
+
+// Result of one seeded fleet pair in an A/B comparison
+typedef struct {
+    int shotsA[2];  // Shots strategy A needed to sink fleet 0 and fleet 1
+    int shotsB[2];  // Shots strategy B needed to sink fleet 0 and fleet 1
+    int failed;     // Set if a strategy made an invalid move
+} MatchResult;
+
+// Running mean and variance of a sample (Welford's method)
+typedef struct {
+    int count;
+    double mean;
+    double m2;
+} RunningStats;
+
 // Global variables
 GameState *gameState;                      // Game state pointer in shared memory
+Player parentPlayer;                       // Strategy attacking for the parent
+Player childPlayer;                        // Strategy attacking for the child
 GtkWidget *playerGridWidget;               // Player's grid widget
 GtkWidget *opponentGridWidget;             // Opponent's grid widget
 GtkWidget *statusLabel;                    // Label to display game status
@@ -67,9 +107,26 @@ int isValidPlacement(int grid[GRID_SIZE][GRID_SIZE], int x, int y, int length, i
 void placeShip(int grid[GRID_SIZE][GRID_SIZE], int length);
 void placeAllShips(int grid[GRID_SIZE][GRID_SIZE]);
 int isValidAttack(int attackedCells[GRID_SIZE][GRID_SIZE], int x, int y);
+void randomAttack(unsigned int *seed, int attackedCells[GRID_SIZE][GRID_SIZE], int *x, int *y);
+void huntReset(void *state, unsigned int seed);
+void huntChooseAttack(void *state, int attackedCells[GRID_SIZE][GRID_SIZE], int *x, int *y);
+void huntRecordResult(void *state, int x, int y, int hit);
+void randomReset(void *state, unsigned int seed);
+void randomChooseAttack(void *state, int attackedCells[GRID_SIZE][GRID_SIZE], int *x, int *y);
+void randomRecordResult(void *state, int x, int y, int hit);
+const Strategy *loadStrategy(const char *spec);
+int createPlayer(Player *player, const Strategy *strategy);
+void resetPlayer(Player *player, unsigned int seed);
+int fireShot(Player *player, int attackedCells[GRID_SIZE][GRID_SIZE], int targetGrid[GRID_SIZE][GRID_SIZE], int *hitX, int *hitY);
 int childAttack(GameState *gameState, int *hitX, int *hitY);
 int parentAttack(GameState *gameState, int *hitX, int *hitY);
 int checkGameOver(int grid[GRID_SIZE][GRID_SIZE]);
+unsigned int mixSeed(unsigned int base, unsigned int index, unsigned int stream);
+int shotsToSink(Player *player, unsigned int seed, int fleet[GRID_SIZE][GRID_SIZE]);
+void playMatches(Player *playerA, Player *playerB, unsigned int baseSeed, int first, int count, MatchResult *results);
+void addSample(RunningStats *stats, double value);
+double confidenceHalfWidth(const RunningStats *stats);
+int runComparison(const char *specA, const char *specB, int games, unsigned int baseSeed);
 void startGame(GameState *gameState);
 void saveGameState(GameState *gameState);
 int loadGameState(GameState *gameState);
@@ -166,13 +223,27 @@ int isValidAttack(int attackedCells[GRID_SIZE][GRID_SIZE], int x, int y) {
     }
 }
 
-// Parent's attack function
-int parentAttack(GameState *gameState, int *hitX, int *hitY) {
-    static int lastHitX = -1, lastHitY = -1; // Coordinates of the last hit
-    int x, y;
+// Picks a random cell that has not been attacked yet
+void randomAttack(unsigned int *seed, int attackedCells[GRID_SIZE][GRID_SIZE], int *x, int *y) {
+    do {
+        *x = rand_r(seed) % GRID_SIZE;
+        *y = rand_r(seed) % GRID_SIZE;
+    } while (!isValidAttack(attackedCells, *x, *y));
+}
+
+// Hunt strategy: random shots until a hit, then the cells around the last hit
+void huntReset(void *state, unsigned int seed) {
+    HuntState *hunt = state;
+    hunt->seed = seed;
+    hunt->lastHitX = -1;
+    hunt->lastHitY = -1;
+}
+
+void huntChooseAttack(void *state, int attackedCells[GRID_SIZE][GRID_SIZE], int *x, int *y) {
+    HuntState *hunt = state;
 
     // If the last attack was a hit, try attacking adjacent cells
-    if (lastHitX != -1 && lastHitY != -1) {
+    if (hunt->lastHitX != -1 && hunt->lastHitY != -1) {
         int directions[4][2] = {
             {-1, 0}, // Left
             {1, 0},  // Right
@@ -180,88 +251,148 @@ int parentAttack(GameState *gameState, int *hitX, int *hitY) {
             {0, 1}   // Down
         };
         for (int i = 0; i < 4; i++) {
-            x = lastHitX + directions[i][0];
-            y = lastHitY + directions[i][1];
-            if (isValidAttack(gameState->parentAttackedCells, x, y)) {
-                goto attack;
+            *x = hunt->lastHitX + directions[i][0];
+            *y = hunt->lastHitY + directions[i][1];
+            if (isValidAttack(attackedCells, *x, *y)) {
+                return;
             }
         }
         // Reset if no valid adjacent cells
-        lastHitX = -1;
-        lastHitY = -1;
+        hunt->lastHitX = -1;
+        hunt->lastHitY = -1;
     }
 
     // Random attack
-    do {
-        x = rand() % GRID_SIZE;
-        y = rand() % GRID_SIZE;
-    } while (!isValidAttack(gameState->parentAttackedCells, x, y));
+    randomAttack(&hunt->seed, attackedCells, x, y);
+}
 
-attack:
-    *hitX = x;
-    *hitY = y;
-    gameState->parentAttackedCells[y][x] = 1; // Mark the cell as attacked
-
-    if (gameState->childGrid[y][x] == 1) {
-        gameState->childGrid[y][x] = 2; // Mark as hit
-        lastHitX = x;
-        lastHitY = y;
-        printf("Parent hit at (%d, %d)\n", x, y);
-        return 1; // Hit
-    } else {
-        gameState->childGrid[y][x] = -1; // Mark as miss
-        printf("Parent missed at (%d, %d)\n", x, y);
-        return 0; // Miss
+void huntRecordResult(void *state, int x, int y, int hit) {
+    HuntState *hunt = state;
+    if (hit) {
+        hunt->lastHitX = x;
+        hunt->lastHitY = y;
     }
 }
 
-// Child's attack function
-int childAttack(GameState *gameState, int *hitX, int *hitY) {
-    static int lastHitX = -1, lastHitY = -1; // Coordinates of the last hit
-    int x, y;
+// Random strategy: every shot goes to a random unattacked cell
+void randomReset(void *state, unsigned int seed) {
+    RandomState *random = state;
+    random->seed = seed;
+}
 
-    // If the last attack was a hit, try attacking adjacent cells
-    if (lastHitX != -1 && lastHitY != -1) {
-        int directions[4][2] = {
-            {-1, 0}, // Left
-            {1, 0},  // Right
-            {0, -1}, // Up
-            {0, 1}   // Down
-        };
-        for (int i = 0; i < 4; i++) {
-            x = lastHitX + directions[i][0];
-            y = lastHitY + directions[i][1];
-            if (isValidAttack(gameState->childAttackedCells, x, y)) {
-                goto attack;
-            }
+void randomChooseAttack(void *state, int attackedCells[GRID_SIZE][GRID_SIZE], int *x, int *y) {
+    RandomState *random = state;
+    randomAttack(&random->seed, attackedCells, x, y);
+}
+
+void randomRecordResult(void *state, int x, int y, int hit) {
+    // Nothing to learn from the result
+}
+
+const Strategy huntStrategy = {
+    STRATEGY_ABI_VERSION, "hunt", sizeof(HuntState),
+    huntReset, huntChooseAttack, huntRecordResult
+};
+
+const Strategy randomStrategy = {
+    STRATEGY_ABI_VERSION, "random", sizeof(RandomState),
+    randomReset, randomChooseAttack, randomRecordResult
+};
+
+// Strategies available without loading a plugin
+const Strategy *builtinStrategies[] = {
+    &huntStrategy,
+    &randomStrategy
+};
+
+int builtinStrategyCount = sizeof(builtinStrategies) / sizeof(builtinStrategies[0]);
+
+// Looks up a built-in strategy by name or loads one from a shared object
+const Strategy *loadStrategy(const char *spec) {
+    for (int i = 0; i < builtinStrategyCount; i++) {
+        if (strcmp(spec, builtinStrategies[i]->name) == 0) {
+            return builtinStrategies[i];
         }
-        // Reset if no valid adjacent cells
-        lastHitX = -1;
-        lastHitY = -1;
     }
 
-    // Random attack
-    do {
-        x = rand() % GRID_SIZE;
-        y = rand() % GRID_SIZE;
-    } while (!isValidAttack(gameState->childAttackedCells, x, y));
+    void *handle = dlopen(spec, RTLD_NOW | RTLD_LOCAL);
+    if (handle == NULL) {
+        fprintf(stderr, "Failed to load strategy %s: %s\n", spec, dlerror());
+        return NULL;
+    }
+    const Strategy *strategy = dlsym(handle, STRATEGY_SYMBOL);
+    if (strategy == NULL) {
+        fprintf(stderr, "Strategy %s does not export %s\n", spec, STRATEGY_SYMBOL);
+        dlclose(handle);
+        return NULL;
+    }
+    if (strategy->abiVersion != STRATEGY_ABI_VERSION || strategy->name == NULL ||
+        strategy->reset == NULL || strategy->chooseAttack == NULL || strategy->recordResult == NULL) {
+        fprintf(stderr, "Strategy %s is incompatible with this game\n", spec);
+        dlclose(handle);
+        return NULL;
+    }
+    // The handle stays open for the lifetime of the program
+    return strategy;
+}
+
+// Binds a strategy to a player and allocates its state
+int createPlayer(Player *player, const Strategy *strategy) {
+    void *state = calloc(1, strategy->stateSize > 0 ? strategy->stateSize : 1);
+    if (state == NULL) {
+        perror("Failed to allocate strategy state");
+        return 0;
+    }
+    free(player->state);
+    player->strategy = strategy;
+    player->state = state;
+    return 1;
+}
+
+// Prepares a player's strategy for a new game
+void resetPlayer(Player *player, unsigned int seed) {
+    player->strategy->reset(player->state, seed);
+}
+
+// Lets the player's strategy fire one shot at the target grid
+// Returns 1 on a hit, 0 on a miss and -1 if the strategy chose an invalid cell
+int fireShot(Player *player, int attackedCells[GRID_SIZE][GRID_SIZE], int targetGrid[GRID_SIZE][GRID_SIZE], int *hitX, int *hitY) {
+    int x, y;
+    player->strategy->chooseAttack(player->state, attackedCells, &x, &y);
+    if (!isValidAttack(attackedCells, x, y)) {
+        return -1;
+    }
 
-attack:
     *hitX = x;
     *hitY = y;
-    gameState->childAttackedCells[y][x] = 1; // Mark the cell as attacked
-
-    if (gameState->parentGrid[y][x] == 1) {
-        gameState->parentGrid[y][x] = 2;  // Mark as hit
-        lastHitX = x;
-        lastHitY = y;
-        printf("Child hit at (%d, %d)\n", x, y);
-        return 1; // Hit
-    } else {
-        gameState->parentGrid[y][x] = -1;  // Mark as miss
-        printf("Child missed at (%d, %d)\n", x, y);
-        return 0; // Miss
+    attackedCells[y][x] = 1; // Mark the cell as attacked
+
+    int hit = targetGrid[y][x] == 1;
+    targetGrid[y][x] = hit ? 2 : -1; // Mark as hit or miss
+    player->strategy->recordResult(player->state, x, y, hit);
+    return hit;
+}
+
+// Parent's attack function
+int parentAttack(GameState *gameState, int *hitX, int *hitY) {
+    int result = fireShot(&parentPlayer, gameState->parentAttackedCells, gameState->childGrid, hitX, hitY);
+    if (result == 1) {
+        printf("Parent hit at (%d, %d)\n", *hitX, *hitY);
+    } else if (result == 0) {
+        printf("Parent missed at (%d, %d)\n", *hitX, *hitY);
     }
+    return result;
+}
+
+// Child's attack function
+int childAttack(GameState *gameState, int *hitX, int *hitY) {
+    int result = fireShot(&childPlayer, gameState->childAttackedCells, gameState->parentGrid, hitX, hitY);
+    if (result == 1) {
+        printf("Child hit at (%d, %d)\n", *hitX, *hitY);
+    } else if (result == 0) {
+        printf("Child missed at (%d, %d)\n", *hitX, *hitY);
+    }
+    return result;
 }
 
 // Displays a message in the status label
@@ -354,6 +485,8 @@ void onPlaceShips(GtkWidget *widget, gpointer data) {
     initializeGrid(gameState->childAttackedCells);
     placeAllShips(gameState->parentGrid);
     placeAllShips(gameState->childGrid);
+    resetPlayer(&parentPlayer, rand());
+    resetPlayer(&childPlayer, rand());
     shipsPlaced = TRUE;
     gameStarted = FALSE;
     gameState->gameStatus[0] = GAME_CONTINUE;
@@ -405,6 +538,8 @@ int loadGameState(GameState *gameState) {
 // Callback for "Load Game" menu item
 void onLoadGame(GtkWidget *widget, gpointer data) {
     if (loadGameState(gameState)) {
+        resetPlayer(&parentPlayer, rand());
+        resetPlayer(&childPlayer, rand());
         shipsPlaced = TRUE;
         gameStarted = FALSE;
         refreshGrid(gameState->parentGrid, TRUE, playerButtons);
@@ -471,6 +606,11 @@ gboolean playGame(gpointer data) {
         gtk_label_set_text(GTK_LABEL(turnLabel), "Current Turn: Parent");
         // Parent's turn
         int result = parentAttack(gameState, &hitX, &hitY);
+        if (result < 0) {
+            displayMessage("Parent's strategy made an invalid move.");
+            gameStarted = FALSE;
+            return FALSE;
+        }
         refreshGrid(gameState->childGrid, TRUE, opponentButtons); // Show opponent's ships
 
         char moveMessage[256];
@@ -496,6 +636,11 @@ gboolean playGame(gpointer data) {
         gtk_label_set_text(GTK_LABEL(turnLabel), "Current Turn: Child");
         // Child's turn
         int result = childAttack(gameState, &hitX, &hitY);
+        if (result < 0) {
+            displayMessage("Child's strategy made an invalid move.");
+            gameStarted = FALSE;
+            return FALSE;
+        }
         refreshGrid(gameState->parentGrid, TRUE, playerButtons);
 
         char moveMessage[256];
@@ -521,6 +666,195 @@ gboolean playGame(gpointer data) {
     return TRUE; // Continue the timer
 }
 
+/* A/B Evaluation Harness */
+
+// Derives an independent seed for one fleet pair and random stream
+unsigned int mixSeed(unsigned int base, unsigned int index, unsigned int stream) {
+    unsigned int h = base ^ (index * 0x9E3779B9u) ^ (stream * 0x85EBCA6Bu);
+    h ^= h >> 16;
+    h *= 0x7FEB352Du;
+    h ^= h >> 15;
+    h *= 0x846CA68Bu;
+    h ^= h >> 16;
+    return h;
+}
+
+// Counts the shots a strategy needs to sink every ship of a fleet
+// Returns -1 if the strategy made an invalid move
+int shotsToSink(Player *player, unsigned int seed, int fleet[GRID_SIZE][GRID_SIZE]) {
+    int grid[GRID_SIZE][GRID_SIZE];
+    int attackedCells[GRID_SIZE][GRID_SIZE];
+    int shipCells = 0;
+    int shots = 0;
+    int hitX, hitY;
+
+    memcpy(grid, fleet, sizeof(grid));
+    initializeGrid(attackedCells);
+    for (int y = 0; y < GRID_SIZE; y++) {
+        for (int x = 0; x < GRID_SIZE; x++) {
+            shipCells += grid[y][x] == 1;
+        }
+    }
+
+    resetPlayer(player, seed);
+    while (shipCells > 0) {
+        int result = fireShot(player, attackedCells, grid, &hitX, &hitY);
+        if (result < 0) {
+            return -1;
+        }
+        shipCells -= result;
+        shots++;
+    }
+    return shots;
+}
+
+// Plays fleet pairs [first, first + count) for strategies A and B
+void playMatches(Player *playerA, Player *playerB, unsigned int baseSeed, int first, int count, MatchResult *results) {
+    int fleets[2][GRID_SIZE][GRID_SIZE];
+
+    for (int i = first; i < first + count; i++) {
+        MatchResult *result = &results[i];
+
+        // The fleets depend only on the pair's seed, not on the worker
+        srand(mixSeed(baseSeed, i, 0));
+        for (int f = 0; f < 2; f++) {
+            initializeGrid(fleets[f]);
+            placeAllShips(fleets[f]);
+        }
+
+        // Both strategies get the same random stream against the same fleet
+        result->failed = 0;
+        for (int f = 0; f < 2; f++) {
+            unsigned int seed = mixSeed(baseSeed, i, f + 1);
+            result->shotsA[f] = shotsToSink(playerA, seed, fleets[f]);
+            result->shotsB[f] = shotsToSink(playerB, seed, fleets[f]);
+            if (result->shotsA[f] < 0 || result->shotsB[f] < 0) {
+                result->failed = 1;
+            }
+        }
+    }
+}
+
+// Adds a value to a running sample
+void addSample(RunningStats *stats, double value) {
+    stats->count++;
+    double delta = value - stats->mean;
+    stats->mean += delta / stats->count;
+    stats->m2 += delta * (value - stats->mean);
+}
+
+// Half-width of the 95% confidence interval of the sample mean
+double confidenceHalfWidth(const RunningStats *stats) {
+    if (stats->count < 2) {
+        return 0.0;
+    }
+    return CONFIDENCE_Z * sqrt(stats->m2 / (stats->count - 1) / stats->count);
+}
+
+// Pits strategy A against strategy B over the same seeded fleets in parallel.
+// Every seed yields two fleets and two games with the sides swapped, so
+// neither strategy profits from moving first. Since a strategy only sees its
+// own shots, each game is decided by who sinks the enemy fleet in fewer shots;
+// the parent moves first and therefore wins ties.
+int runComparison(const char *specA, const char *specB, int games, unsigned int baseSeed) {
+    Player playerA = {NULL, NULL};
+    Player playerB = {NULL, NULL};
+    const Strategy *strategyA = loadStrategy(specA);
+    const Strategy *strategyB = loadStrategy(specB);
+    if (strategyA == NULL || strategyB == NULL ||
+        !createPlayer(&playerA, strategyA) || !createPlayer(&playerB, strategyB)) {
+        return 1;
+    }
+
+    // Results live in shared memory so the workers can fill them in place
+    int shmid = shmget(IPC_PRIVATE, sizeof(MatchResult) * games, IPC_CREAT | 0600);
+    if (shmid < 0) {
+        perror("shmget failed");
+        return 1;
+    }
+    MatchResult *results = (MatchResult *)shmat(shmid, NULL, 0);
+    shmctl(shmid, IPC_RMID, NULL); // Removed once every process has detached
+    if (results == (MatchResult *)-1) {
+        perror("shmat failed");
+        return 1;
+    }
+
+    long workers = sysconf(_SC_NPROCESSORS_ONLN);
+    if (workers < 1) {
+        workers = 1;
+    }
+    if (workers > games) {
+        workers = games;
+    }
+
+    // Each worker plays a contiguous range of seeds
+    int failed = 0;
+    fflush(stdout);
+    for (long w = 0; w < workers; w++) {
+        int first = (int)((long long)games * w / workers);
+        int count = (int)((long long)games * (w + 1) / workers) - first;
+        pid_t pid = fork();
+        if (pid < 0) {
+            perror("fork failed");
+            failed = 1;
+            break;
+        }
+        if (pid == 0) {
+            playMatches(&playerA, &playerB, baseSeed, first, count, results);
+            shmdt(results);
+            _exit(0);
+        }
+    }
+    int status;
+    while (wait(&status) > 0) {
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+            failed = 1;
+        }
+    }
+    if (failed) {
+        fprintf(stderr, "A/B comparison failed\n");
+        shmdt(results);
+        return 1;
+    }
+
+    // Statistics are gathered in seed order, independent of the worker count
+    RunningStats winRate = {0, 0.0, 0.0};
+    RunningStats shotDiff = {0, 0.0, 0.0};
+    RunningStats shotsA = {0, 0.0, 0.0};
+    RunningStats shotsB = {0, 0.0, 0.0};
+    for (int i = 0; i < games; i++) {
+        MatchResult *r = &results[i];
+        if (r->failed) {
+            fprintf(stderr, "A strategy made an invalid move (game %d)\n", i);
+            shmdt(results);
+            return 1;
+        }
+        // Game 1: A is the parent and attacks fleet 1, B attacks fleet 0
+        // Game 2: B is the parent and attacks fleet 1, A attacks fleet 0
+        int wins = (r->shotsA[1] <= r->shotsB[0]) + (r->shotsA[0] < r->shotsB[1]);
+        addSample(&winRate, wins / 2.0);
+        addSample(&shotDiff, (r->shotsA[0] + r->shotsA[1] - r->shotsB[0] - r->shotsB[1]) / 2.0);
+        addSample(&shotsA, (r->shotsA[0] + r->shotsA[1]) / 2.0);
+        addSample(&shotsB, (r->shotsB[0] + r->shotsB[1]) / 2.0);
+    }
+    shmdt(results);
+
+    printf("%s vs %s: %d seeded fleet pairs (seed %u, %ld workers)\n",
+           strategyA->name, strategyB->name, games, baseSeed, workers);
+    printf("  Shots to sink a fleet: %s %.2f +/- %.2f, %s %.2f +/- %.2f\n",
+           strategyA->name, shotsA.mean, confidenceHalfWidth(&shotsA),
+           strategyB->name, shotsB.mean, confidenceHalfWidth(&shotsB));
+    printf("  Paired shot difference (%s - %s): %.2f +/- %.2f\n",
+           strategyA->name, strategyB->name, shotDiff.mean, confidenceHalfWidth(&shotDiff));
+    printf("  Win rate of %s: %.3f +/- %.3f\n",
+           strategyA->name, winRate.mean, confidenceHalfWidth(&winRate));
+    printf("  (+/- is the 95%% confidence interval over the paired seeds)\n");
+
+    free(playerA.state);
+    free(playerB.state);
+    return 0;
+}
+
 int main(int argc, char *argv[]) {
     GtkWidget *window;
     GtkWidget *mainGrid;
@@ -533,8 +867,40 @@ int main(int argc, char *argv[]) {
     GtkWidget *movesScrolledWindow; // Added scrolled window for moves history
     GtkCssProvider *cssProvider;
 
+    // Headless A/B comparison: --ab <strategyA> <strategyB> [games] [seed]
+    if (argc >= 4 && strcmp(argv[1], "--ab") == 0) {
+        int games = argc > 4 ? atoi(argv[4]) : DEFAULT_AB_GAMES;
+        unsigned int seed = argc > 5 ? (unsigned int)strtoul(argv[5], NULL, 10) : 1;
+        if (games < 2) {
+            fprintf(stderr, "An A/B comparison needs at least 2 games\n");
+            return 1;
+        }
+        return runComparison(argv[2], argv[3], games, seed);
+    }
+
     gtk_init(&argc, &argv);
 
+    // Strategies are a built-in name or the path of a plugin
+    const char *parentSpec = DEFAULT_STRATEGY;
+    const char *childSpec = DEFAULT_STRATEGY;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--parent") == 0 && i + 1 < argc) {
+            parentSpec = argv[++i];
+        } else if (strcmp(argv[i], "--child") == 0 && i + 1 < argc) {
+            childSpec = argv[++i];
+        } else {
+            fprintf(stderr, "Usage: %s [--parent STRATEGY] [--child STRATEGY]\n"
+                            "       %s --ab STRATEGY_A STRATEGY_B [GAMES] [SEED]\n", argv[0], argv[0]);
+            exit(1);
+        }
+    }
+    const Strategy *parentStrategy = loadStrategy(parentSpec);
+    const Strategy *childStrategy = loadStrategy(childSpec);
+    if (parentStrategy == NULL || childStrategy == NULL ||
+        !createPlayer(&parentPlayer, parentStrategy) || !createPlayer(&childPlayer, childStrategy)) {
+        exit(1);
+    }
+
     // Shared Memory Allocation
     int shmid = shmget(SHM_KEY, sizeof(GameState), IPC_CREAT | 0666);
     if (shmid < 0) {
@@ -549,6 +915,8 @@ int main(int argc, char *argv[]) {
 
     // Initialize game state
     srand(time(NULL));
+    resetPlayer(&parentPlayer, rand());
+    resetPlayer(&childPlayer, rand());
     initializeGrid(gameState->parentGrid);
     initializeGrid(gameState->childGrid);
     initializeGrid(gameState->parentAttackedCells);
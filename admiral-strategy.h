@@ -0,0 +1,41 @@
+/* admiral-strategy.h */
+
+#ifndef ADMIRAL_STRATEGY_H
+#define ADMIRAL_STRATEGY_H
+
+#include <stddef.h>
+
+#define GRID_SIZE 8                        // Size of the game grid (8x8)
+
+#define STRATEGY_ABI_VERSION 1             // Bumped whenever the Strategy table changes
+#define STRATEGY_SYMBOL "admiralStrategy"  // Symbol a plugin exports to describe itself
+
+// Function table describing an attack strategy.
+//
+// The game owns the per-instance state: it allocates stateSize bytes once per
+// player and passes that block to every callback, so one strategy can drive
+// both sides (or many simulated games) without sharing anything. A strategy
+// only ever sees its own shots and their results, never the opponent's grid.
+//
+// A plugin is a shared object exporting a Strategy named "admiralStrategy":
+//
+//     const Strategy admiralStrategy = { STRATEGY_ABI_VERSION, "name", ... };
+typedef struct {
+    int abiVersion;     // Must be STRATEGY_ABI_VERSION
+    const char *name;   // Short name used in reports
+    size_t stateSize;   // Bytes of per-instance state (may be 0)
+
+    // Prepares the state for a new game. All randomness must come from seed so
+    // that a game can be replayed exactly.
+    void (*reset)(void *state, unsigned int seed);
+
+    // Picks the next cell to attack. attackedCells marks (with 1) every cell
+    // this player has already fired at and must not be modified; the chosen
+    // cell has to be inside the grid and not attacked yet.
+    void (*chooseAttack)(void *state, int attackedCells[GRID_SIZE][GRID_SIZE], int *x, int *y);
+
+    // Reports the outcome of the attack just chosen (hit is 1 or 0).
+    void (*recordResult)(void *state, int x, int y, int hit);
+} Strategy;
+
+#endif /* ADMIRAL_STRATEGY_H */
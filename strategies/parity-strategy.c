@@ -0,0 +1,88 @@
+/* parity-strategy.c */
+
+// Example strategy plugin. Build with:
+//     gcc -shared -fPIC -o parity.so strategies/parity-strategy.c
+// and pass ./parity.so wherever a strategy is expected.
+
+#include <stdlib.h>
+
+#include "../admiral-strategy.h"
+
+#define MAX_TARGETS (GRID_SIZE * GRID_SIZE)  // Upper bound of queued cells
+
+// Per-instance state
+typedef struct {
+    unsigned int seed;              // rand_r() state
+    int targetCount;                // Number of queued cells
+    int targetX[MAX_TARGETS];       // Cells next to earlier hits
+    int targetY[MAX_TARGETS];
+} ParityState;
+
+// Checks if a cell is inside the grid and has not been attacked yet
+static int isOpen(int attackedCells[GRID_SIZE][GRID_SIZE], int x, int y) {
+    return x >= 0 && x < GRID_SIZE && y >= 0 && y < GRID_SIZE && attackedCells[y][x] == 0;
+}
+
+static void parityReset(void *state, unsigned int seed) {
+    ParityState *parity = state;
+    parity->seed = seed;
+    parity->targetCount = 0;
+}
+
+// Works through the cells next to earlier hits first; otherwise fires at a
+// random cell of one checkerboard colour, since every ship covers at least
+// two cells and therefore always touches both colours.
+static void parityChooseAttack(void *state, int attackedCells[GRID_SIZE][GRID_SIZE], int *x, int *y) {
+    ParityState *parity = state;
+
+    while (parity->targetCount > 0) {
+        parity->targetCount--;
+        *x = parity->targetX[parity->targetCount];
+        *y = parity->targetY[parity->targetCount];
+        if (isOpen(attackedCells, *x, *y)) {
+            return;
+        }
+    }
+
+    // Random cell of the search colour, or any open cell once those run out
+    int open = 0, parityOpen = 0;
+    for (int cy = 0; cy < GRID_SIZE; cy++) {
+        for (int cx = 0; cx < GRID_SIZE; cx++) {
+            if (attackedCells[cy][cx] == 0) {
+                open++;
+                parityOpen += (cx + cy) % 2 == 0;
+            }
+        }
+    }
+    int useParity = parityOpen > 0;
+    int pick = rand_r(&parity->seed) % (useParity ? parityOpen : open);
+    for (int cy = 0; cy < GRID_SIZE; cy++) {
+        for (int cx = 0; cx < GRID_SIZE; cx++) {
+            if (attackedCells[cy][cx] == 0 && (!useParity || (cx + cy) % 2 == 0) && pick-- == 0) {
+                *x = cx;
+                *y = cy;
+                return;
+            }
+        }
+    }
+}
+
+static void parityRecordResult(void *state, int x, int y, int hit) {
+    ParityState *parity = state;
+    int directions[4][2] = {{-1, 0}, {1, 0}, {0, -1}, {0, 1}};
+
+    if (!hit) {
+        return;
+    }
+    // Queue the neighbours; cells already attacked are skipped when popped
+    for (int i = 0; i < 4 && parity->targetCount < MAX_TARGETS; i++) {
+        parity->targetX[parity->targetCount] = x + directions[i][0];
+        parity->targetY[parity->targetCount] = y + directions[i][1];
+        parity->targetCount++;
+    }
+}
+
+const Strategy admiralStrategy = {
+    STRATEGY_ABI_VERSION, "parity", sizeof(ParityState),
+    parityReset, parityChooseAttack, parityRecordResult
+};